@@ -23,6 +23,8 @@ constexpr int FRUIT_TARGET_SIZE = 20;
 constexpr int FRUIT_START_SIZE = 50;
 constexpr int PROJECTILE_SIZE = 20;
 constexpr int MAX_PROJECTILES = 3;
+constexpr int AI_DECISIONS_PER_TICK = 2;   // At most this many AIs refresh their decision per tick
+constexpr float AI_THREAT_RADIUS = 150.0f; // Player or enemy projectiles closer than this raise AI priority
 
 // === Structs ===
 struct Projectile {
@@ -89,6 +91,23 @@ void initFruitTargets(int numFruits) {
     }
 }
 
+// === AI Decisions ===
+// Each AI keeps its last decision and only refreshes it when the scheduler gives it a turn
+struct AIDecision {
+	int targetIdx;		// Nearest fruit to shoot at, -1 if not decided yet
+	bool threatened;	// Player or an enemy projectile was close at the last refresh
+	bool canShootNow;	// No projectile overlapped the AI at the last refresh
+	int staleTicks;		// Ticks since this decision was last refreshed
+};
+
+AIDecision aiDecisions[5];
+
+void initAIDecisions(int numFruits) {
+    for (int i = 0; i < numFruits; ++i) {
+        aiDecisions[i] = {-1, false, false, 0};
+    }
+}
+
 // === Rendering Functions ===
 void renderRect(SDL_Renderer* renderer, const SDL_Rect& rect, SDL_Color color) {
 	SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, 255);
@@ -345,25 +364,167 @@ void createProjectile(std::vector<Projectile>& projectiles, int owner, float x,
     projectiles.push_back({x, y, dx * PROJECTILE_SPEED, dy * PROJECTILE_SPEED, PROJECTILE_SIZE, PROJECTILE_SIZE, color, owner});
 }
 
-// Handle projectile collisions and shrinking
-void handleProjectileCollisions(std::vector<Projectile>& projectiles, SDL_Rect* fruitRects, int numFruits, bool aiVsAiMode) {
-    projectiles.erase(
-        std::remove_if(projectiles.begin(), projectiles.end(), [&](const Projectile& proj) {
-            SDL_Rect projRect = {static_cast<int>(proj.x), static_cast<int>(proj.y), proj.w, proj.h};
-            for (int i = 0; i < numFruits; ++i) {
-                if (i == proj.owner) continue;
-                if (SDL_HasIntersection(&projRect, &fruitRects[i])) {
-                    int shrink = aiVsAiMode ? 2 : 5;
-                    fruitRects[i].w = std::max(FRUIT_MIN_SIZE, fruitRects[i].w - shrink);
-                    fruitRects[i].h = std::max(FRUIT_MIN_SIZE, fruitRects[i].h - shrink);
-                    keepInBounds(fruitRects[i]);
-                    return true;
-                }
+// Earliest time in [0, 1] at which a box at (x, y) moving by (vx, vy) this tick overlaps the box (x0, y0)-(x1, y1).
+// The target is grown by the projectile size, so this is a ray against a box and nothing is skipped at high speed.
+// Returns a value above 1 if there is no hit this tick.
+float sweptHitTime(float x, float y, float vx, float vy, float w, float h, float x0, float y0, float x1, float y1) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    float lox = x0 - w, hix = x1;
+    float loy = y0 - h, hiy = y1;
+    float enterX = -inf, exitX = inf;
+    if (vx != 0.0f) {
+        enterX = (lox - x) / vx;
+        exitX = (hix - x) / vx;
+        if (enterX > exitX) std::swap(enterX, exitX);
+    } else if (x <= lox || x >= hix) {
+        return inf;
+    }
+    float enterY = -inf, exitY = inf;
+    if (vy != 0.0f) {
+        enterY = (loy - y) / vy;
+        exitY = (hiy - y) / vy;
+        if (enterY > exitY) std::swap(enterY, exitY);
+    } else if (y <= loy || y >= hiy) {
+        return inf;
+    }
+    float enter = std::max(enterX, enterY);
+    float exit = std::min(exitX, exitY);
+    if (enter >= exit || exit <= 0.0f || enter >= 1.0f) return inf;
+    return std::max(enter, 0.0f);
+}
+
+// Move projectiles one tick and handle collisions and shrinking.
+// Each projectile is swept against every fruit using their velocity relative to each other, with the fruit
+// starting from where it was before it moved this tick, so hits are found even if either would jump past the other.
+void handleProjectileCollisions(std::vector<Projectile>& projectiles, SDL_Rect* fruitRects, const SDL_Rect* prevFruitRects, int numFruits, bool aiVsAiMode) {
+    // Fruit bounds at the start of the tick and fruit movement this tick, as flat float arrays
+    float fx0[5], fy0[5], fx1[5], fy1[5], fvx[5], fvy[5];
+    for (int i = 0; i < numFruits; ++i) {
+        fvx[i] = static_cast<float>(fruitRects[i].x - prevFruitRects[i].x);
+        fvy[i] = static_cast<float>(fruitRects[i].y - prevFruitRects[i].y);
+        fx0[i] = static_cast<float>(prevFruitRects[i].x);
+        fy0[i] = static_cast<float>(prevFruitRects[i].y);
+        fx1[i] = static_cast<float>(prevFruitRects[i].x + prevFruitRects[i].w);
+        fy1[i] = static_cast<float>(prevFruitRects[i].y + prevFruitRects[i].h);
+    }
+    size_t kept = 0;
+    for (size_t p = 0; p < projectiles.size(); ++p) {
+        Projectile proj = projectiles[p];
+        float bestT = std::numeric_limits<float>::infinity();
+        int hitIdx = -1;
+        for (int i = 0; i < numFruits; ++i) {
+            if (i == proj.owner) continue;
+            float t = sweptHitTime(proj.x, proj.y, proj.vx - fvx[i], proj.vy - fvy[i], static_cast<float>(proj.w), static_cast<float>(proj.h), fx0[i], fy0[i], fx1[i], fy1[i]);
+            if (t < bestT) {
+                bestT = t;
+                hitIdx = i;
             }
-            return proj.x < 0 || proj.y < 0 || proj.x + proj.w > WINDOW_WIDTH || proj.y + proj.h > WINDOW_HEIGHT;
-        }),
-        projectiles.end()
-    );
+        }
+        if (hitIdx != -1) {
+            int shrink = aiVsAiMode ? 2 : 5;
+            SDL_Rect& fruit = fruitRects[hitIdx];
+            fruit.w = std::max(FRUIT_MIN_SIZE, fruit.w - shrink);
+            fruit.h = std::max(FRUIT_MIN_SIZE, fruit.h - shrink);
+            keepInBounds(fruit);
+            // Later projectiles see the shrunk fruit, moving the same way this tick
+            fx0[hitIdx] = fruit.x - fvx[hitIdx];
+            fy0[hitIdx] = fruit.y - fvy[hitIdx];
+            fx1[hitIdx] = fx0[hitIdx] + fruit.w;
+            fy1[hitIdx] = fy0[hitIdx] + fruit.h;
+            continue;
+        }
+        proj.x += proj.vx;
+        proj.y += proj.vy;
+        if (proj.x < 0 || proj.y < 0 || proj.x + proj.w > WINDOW_WIDTH || proj.y + proj.h > WINDOW_HEIGHT) continue;
+        projectiles[kept++] = proj;
+    }
+    projectiles.resize(kept);
+}
+
+// === AI Scheduling ===
+// Squared distance between the centers of two rectangles
+float centerDistSq(float ax, float ay, const SDL_Rect& b) {
+    float dx = (b.x + b.w / 2.0f) - ax;
+    float dy = (b.y + b.h / 2.0f) - ay;
+    return dx * dx + dy * dy;
+}
+
+// Nearest other fruit to fruit i, used as its shooting target
+int findNearestFruit(int i, int numFruits, SDL_Rect* fruitRects) {
+    float cx = fruitRects[i].x + fruitRects[i].w / 2.0f;
+    float cy = fruitRects[i].y + fruitRects[i].h / 2.0f;
+    float minDist = std::numeric_limits<float>::max();
+    int targetIdx = 0;
+    for (int j = 0; j < numFruits; ++j) {
+        if (i == j) continue;
+        float dist = centerDistSq(cx, cy, fruitRects[j]);
+        if (dist < minDist) {
+            minDist = dist;
+            targetIdx = j;
+        }
+    }
+    return targetIdx;
+}
+
+// Refresh the cached decision of AI i: its target, whether it is threatened and whether it may shoot.
+// This is the only AI code that looks at every projectile, so it is what the scheduler rations.
+void runAIDecision(int i, bool aiVsAiMode, int numFruits, SDL_Rect* fruitRects, const std::vector<Projectile>& projectiles) {
+    AIDecision& decision = aiDecisions[i];
+    float threatRadiusSq = AI_THREAT_RADIUS * AI_THREAT_RADIUS;
+    decision.targetIdx = findNearestFruit(i, numFruits, fruitRects);
+    decision.threatened = false;
+    decision.canShootNow = true;
+    decision.staleTicks = 0;
+    if (!aiVsAiMode && i != 0) {
+        float cx = fruitRects[0].x + fruitRects[0].w / 2.0f;
+        float cy = fruitRects[0].y + fruitRects[0].h / 2.0f;
+        decision.threatened = centerDistSq(cx, cy, fruitRects[i]) < threatRadiusSq;
+    }
+    for (const auto& proj : projectiles) {
+        // Only shoot if not intersecting with self
+        SDL_Rect projRect = {static_cast<int>(proj.x), static_cast<int>(proj.y), proj.w, proj.h};
+        if (SDL_HasIntersection(&projRect, &fruitRects[i])) decision.canShootNow = false;
+        if (proj.owner != i && !decision.threatened) {
+            float cx = proj.x + proj.w / 2.0f;
+            float cy = proj.y + proj.h / 2.0f;
+            decision.threatened = centerDistSq(cx, cy, fruitRects[i]) < threatRadiusSq;
+        }
+    }
+}
+
+// Shoot at the cached target of AI i if its last decision allows it
+void handleAIShooting(int i, int* fruitProjectiles, SDL_Rect* fruitRects, std::vector<Projectile>& projectiles) {
+    AIDecision& decision = aiDecisions[i];
+    if (decision.targetIdx == -1 || !decision.canShootNow || fruitProjectiles[i] <= 0) return;
+    const SDL_Rect& target = fruitRects[decision.targetIdx];
+    float px = fruitRects[i].x + fruitRects[i].w / 2.0f - PROJECTILE_SIZE / 2.0f;
+    float py = fruitRects[i].y + fruitRects[i].h / 2.0f - PROJECTILE_SIZE / 2.0f;
+    float dx = (target.x + target.w / 2.0f) - (fruitRects[i].x + fruitRects[i].w / 2.0f);
+    float dy = (target.y + target.h / 2.0f) - (fruitRects[i].y + fruitRects[i].h / 2.0f);
+    createProjectile(projectiles, i, px, py, dx, dy, fruitColors[i]);
+    fruitProjectiles[i]--;
+    // The new projectile overlaps the AI until its next refresh
+    decision.canShootNow = false;
+}
+
+// Refresh the decisions of at most AI_DECISIONS_PER_TICK AIs, most urgent first, so the per-tick cost stays flat.
+// Priority only reads cached fields: ticks since the last refresh, plus a bonus if the AI was threatened.
+// AIs without projectiles can't shoot, so they are skipped and keep aging until they refill.
+void scheduleAIDecisions(bool aiVsAiMode, int numFruits, int* fruitProjectiles, SDL_Rect* fruitRects, const std::vector<Projectile>& projectiles) {
+    int priority[5] = {0, 0, 0, 0, 0};
+    int order[5];
+    int numReady = 0;
+    for (int i = (aiVsAiMode ? 0 : 1); i < numFruits; ++i) {
+        aiDecisions[i].staleTicks++;
+        if (fruitProjectiles[i] <= 0) continue;
+        priority[i] = aiDecisions[i].staleTicks + (aiDecisions[i].threatened ? numFruits : 0);
+        order[numReady++] = i;
+    }
+    std::stable_sort(order, order + numReady, [&](int a, int b) { return priority[a] > priority[b]; });
+    int maxDecisions = std::min(numReady, AI_DECISIONS_PER_TICK);
+    for (int k = 0; k < maxDecisions; ++k) {
+        runAIDecision(order[k], aiVsAiMode, numFruits, fruitRects, projectiles);
+    }
 }
 
 // === Main Game Loop Modularization ===
@@ -420,42 +581,17 @@ void updateGameLogic(bool& running, bool aiVsAiMode, bool useAI, bool aiCanShoot
         fruitProjectiles[0]--;
         appleShootPressed = false;
     }
-    // AI shooting
+    // AI decisions keep refreshing while shooting is off, so nothing stale fires when it is turned back on
+    if (useAI) scheduleAIDecisions(aiVsAiMode, numFruits, fruitProjectiles, fruitRects, projectiles);
+    // AI shooting (acts on cached decisions, see scheduleAIDecisions)
     if (useAI && aiCanShoot) {
         for (int i = (aiVsAiMode ? 0 : 1); i < numFruits; ++i) {
-            if (fruitProjectiles[i] > 0) {
-                float minDist = std::numeric_limits<float>::max();
-                int targetIdx = 0;
-                for (int j = 0; j < numFruits; ++j) {
-                    if (i == j) continue;
-                    float dx = (fruitRects[j].x + fruitRects[j].w/2.0f) - (fruitRects[i].x + fruitRects[i].w/2.0f);
-                    float dy = (fruitRects[j].y + fruitRects[j].h/2.0f) - (fruitRects[i].y + fruitRects[i].h/2.0f);
-                    float dist = dx*dx + dy*dy;
-                    if (dist < minDist) {
-                        minDist = dist;
-                        targetIdx = j;
-                    }
-                }
-                // Only shoot if not intersecting with self
-                bool canShootNow = true;
-                for (const auto& proj : projectiles) {
-                    SDL_Rect projRect = {static_cast<int>(proj.x), static_cast<int>(proj.y), proj.w, proj.h};
-                    if (SDL_HasIntersection(&projRect, &fruitRects[i])) {
-                        canShootNow = false;
-                        break;
-                    }
-                }
-                if (canShootNow) {
-                    float px = fruitRects[i].x + fruitRects[i].w / 2.0f - PROJECTILE_SIZE / 2.0f;
-                    float py = fruitRects[i].y + fruitRects[i].h / 2.0f - PROJECTILE_SIZE / 2.0f;
-                    float dx = (fruitRects[targetIdx].x + fruitRects[targetIdx].w / 2.0f) - (fruitRects[i].x + fruitRects[i].w / 2.0f);
-                    float dy = (fruitRects[targetIdx].y + fruitRects[targetIdx].h / 2.0f) - (fruitRects[i].y + fruitRects[i].h / 2.0f);
-                    createProjectile(projectiles, i, px, py, dx, dy, fruitColors[i]);
-                    fruitProjectiles[i]--;
-                }
-            }
+            handleAIShooting(i, fruitProjectiles, fruitRects, projectiles);
         }
     }
+    // Remember where the fruits were so projectiles can be swept against their movement
+    SDL_Rect prevFruitRects[5];
+    std::copy(fruitRects, fruitRects + numFruits, prevFruitRects);
     // Player movement
     if (!aiVsAiMode) handlePlayerMovement(fruitRects[0], {SDL_SCANCODE_W, SDL_SCANCODE_S, SDL_SCANCODE_A, SDL_SCANCODE_D});
     if (useAI) {
@@ -465,13 +601,8 @@ void updateGameLogic(bool& running, bool aiVsAiMode, bool useAI, bool aiCanShoot
     } else if (numFruits > 1) {
         handlePlayerMovement(fruitRects[1], {SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT});
     }
-    // Update projectiles
-    for (auto& proj : projectiles) {
-        proj.x += proj.vx;
-        proj.y += proj.vy;
-    }
-    // Handle projectile collisions
-    handleProjectileCollisions(projectiles, fruitRects, numFruits, aiVsAiMode);
+    // Move projectiles and handle collisions
+    handleProjectileCollisions(projectiles, fruitRects, prevFruitRects, numFruits, aiVsAiMode);
 }
 
 // Rendering
@@ -640,6 +771,7 @@ int main(int argc, char* argv[]) {
     // Init fruit rectangles and targets for the correct number of fruits
     initFruitRects(numFruits);
     initFruitTargets(numFruits);
+    initAIDecisions(numFruits);
 
     // Init projectiles
     std::vector<Projectile> projectiles;